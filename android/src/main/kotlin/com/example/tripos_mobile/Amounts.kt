@@ -0,0 +1,23 @@
+package com.example.tripos_mobile
+
+import java.math.BigDecimal
+import java.math.RoundingMode
+
+/** Thrown by [toAmount] for NaN or infinite input; reported to Flutter as INVALID_AMOUNT. */
+internal class InvalidAmountException : IllegalArgumentException("Amount must be a finite number")
+
+// Converts a Flutter amount to an exact BigDecimal in cents, rounding halves away
+// from zero (HALF_UP, same as the iOS plugin). BigDecimal.valueOf goes through
+// Double.toString, so 10.1 stays 10.10 instead of BigDecimal(Double)'s binary expansion.
+internal fun toAmount(value: Number): BigDecimal {
+    val decimal = when (value) {
+        is Int, is Long, is Short, is Byte -> BigDecimal.valueOf(value.toLong())
+        is BigDecimal -> value
+        else -> {
+            val amount = value.toDouble()
+            if (!amount.isFinite()) throw InvalidAmountException()
+            BigDecimal.valueOf(amount)
+        }
+    }
+    return decimal.setScale(2, RoundingMode.HALF_UP)
+}
@@ -0,0 +1,60 @@
+package com.example.tripos_mobile
+
+import java.lang.reflect.AccessibleObject
+import java.lang.reflect.Field
+import java.lang.reflect.Method
+import java.util.concurrent.ConcurrentHashMap
+
+/**
+ * Reads SDK response properties by name through reflective accessors that are
+ * resolved once per class and property name.
+ *
+ * A failed getMethod/getDeclaredField throws, which costs far more than the
+ * invoke itself, so misses are cached as well (as an empty list).
+ */
+internal object PropertyReader {
+    internal val accessorCache =
+        ConcurrentHashMap<Class<*>, ConcurrentHashMap<String, List<AccessibleObject>>>()
+
+    // Reads a property through its cached accessors (getXxx, then field),
+    // returning the first non-null value
+    fun read(obj: Any, name: String): Any? {
+        val accessors = accessorCache
+            .getOrPut(obj.javaClass) { ConcurrentHashMap() }
+            .getOrPut(name) { resolveAccessors(obj.javaClass, name) }
+
+        for (accessor in accessors) {
+            try {
+                val result = when (accessor) {
+                    is Method -> accessor.invoke(obj)
+                    is Field -> accessor.get(obj)
+                    else -> null
+                }
+                if (result != null) return result
+            } catch (e: Exception) { /* Try next */ }
+        }
+        return null
+    }
+
+    private fun resolveAccessors(objClass: Class<*>, name: String): List<AccessibleObject> {
+        val accessors = mutableListOf<AccessibleObject>()
+
+        // Try getter method (getXxx), as given and with uppercase first char
+        for (getterName in linkedSetOf("get$name", "get${name.replaceFirstChar { it.uppercase() }}")) {
+            try {
+                accessors.add(objClass.getMethod(getterName))
+            } catch (e: Exception) { /* Not available */ }
+        }
+
+        // Try direct field access, as given and lowercase
+        for (fieldName in linkedSetOf(name, name.lowercase())) {
+            try {
+                val field = objClass.getDeclaredField(fieldName)
+                field.isAccessible = true
+                accessors.add(field)
+            } catch (e: Exception) { /* Not available */ }
+        }
+
+        return accessors
+    }
+}
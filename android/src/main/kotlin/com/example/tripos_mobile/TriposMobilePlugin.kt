@@ -347,6 +347,19 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
             return
         }
         
+        // Build (and validate) the request before cancelling whatever the device is doing
+        val saleRequest = try {
+            buildSaleRequest(call.arguments as? Map<*, *> ?: emptyMap<String, Any>())
+        } catch (e: InvalidAmountException) {
+            result.error("INVALID_AMOUNT", e.message, null)
+            return
+        } catch (e: Exception) {
+            Log.e(TAG, "processSale exception: ${e.message}", e)
+            result.error("SALE_ERROR", e.message, null)
+            return
+        }
+        Log.i(TAG, "Sale request built: amount=${saleRequest.transactionAmount}")
+        
         // Run on background thread to allow for delay
         Thread {
             try {
@@ -361,10 +374,6 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
                     Log.d(TAG, "No flow to cancel or cancel error: ${e.message}")
                 }
                 
-                val requestMap = call.arguments as? Map<*, *> ?: emptyMap<String, Any>()
-                val saleRequest = buildSaleRequest(requestMap)
-                Log.i(TAG, "Sale request built: amount=${saleRequest.transactionAmount}")
-                
                 mainHandler.post {
                     setupStatusListener()
                 }
@@ -534,6 +543,8 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
                     }
                 }
             }, null)
+        } catch (e: InvalidAmountException) {
+            result.error("INVALID_AMOUNT", e.message, null)
         } catch (e: Exception) {
             result.error("REFUND_ERROR", e.message, null)
         }
@@ -552,7 +563,7 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         try {
             val requestMap = call.arguments as? Map<*, *> ?: emptyMap<String, Any>()
             val transactionId = requestMap["transactionId"] as? String
-            val amount = (requestMap["transactionAmount"] as? Number)?.toDouble() ?: 0.0
+            val amount = toAmount(requestMap["transactionAmount"] as? Number ?: 0)
             
             if (transactionId.isNullOrEmpty()) {
                 result.error("INVALID_REQUEST", "transactionId is required for linked refund", null)
@@ -563,7 +574,7 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
             
             // Build refund request with original transaction ID
             val refundRequest = RefundRequest()
-            refundRequest.transactionAmount = java.math.BigDecimal(amount)
+            refundRequest.transactionAmount = amount
             refundRequest.referenceNumber = requestMap["referenceNumber"] as? String 
                 ?: System.currentTimeMillis().toString()
             refundRequest.laneNumber = ((requestMap["laneNumber"] as? Number)?.toInt() ?: 1).toString()
@@ -607,6 +618,8 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
                     }
                 }
             }, null)
+        } catch (e: InvalidAmountException) {
+            result.error("INVALID_AMOUNT", e.message, null)
         } catch (e: Exception) {
             Log.e(TAG, "processLinkedRefund exception: ${e.message}", e)
             result.error("LINKED_REFUND_ERROR", e.message, null)
@@ -639,6 +652,8 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
                     }
                 }
             })
+        } catch (e: InvalidAmountException) {
+            result.error("INVALID_AMOUNT", e.message, null)
         } catch (e: Exception) {
             result.error("VOID_ERROR", e.message, null)
         }
@@ -672,6 +687,8 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
                     }
                 }
             }, null)
+        } catch (e: InvalidAmountException) {
+            result.error("INVALID_AMOUNT", e.message, null)
         } catch (e: Exception) {
             result.error("AUTH_ERROR", e.message, null)
         }
@@ -853,7 +870,7 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
     // Request builders
     private fun buildSaleRequest(requestMap: Map<*, *>): SaleRequest {
         val request = SaleRequest()
-        request.transactionAmount = BigDecimal((requestMap["transactionAmount"] as? Number)?.toDouble() ?: 0.0)
+        request.transactionAmount = toAmount(requestMap["transactionAmount"] as? Number ?: 0)
         request.laneNumber = requestMap["laneNumber"] as? String ?: "1"
         request.referenceNumber = requestMap["referenceNumber"] as? String ?: ""
         request.clerkNumber = requestMap["clerkNumber"] as? String
@@ -868,16 +885,16 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         } catch (e: Exception) { /* Method not available */ }
         
         (requestMap["convenienceFeeAmount"] as? Number)?.let {
-            request.convenienceFeeAmount = BigDecimal(it.toDouble())
+            request.convenienceFeeAmount = toAmount(it)
         }
         (requestMap["salesTaxAmount"] as? Number)?.let {
-            request.salesTaxAmount = BigDecimal(it.toDouble())
+            request.salesTaxAmount = toAmount(it)
         }
         (requestMap["tipAmount"] as? Number)?.let {
-            request.tipAmount = BigDecimal(it.toDouble())
+            request.tipAmount = toAmount(it)
         }
         (requestMap["surchargeFeeAmount"] as? Number)?.let {
-            request.surchargeFeeAmount = BigDecimal(it.toDouble())
+            request.surchargeFeeAmount = toAmount(it)
         }
         
         return request
@@ -885,7 +902,7 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
 
     private fun buildRefundRequest(requestMap: Map<*, *>): RefundRequest {
         val request = RefundRequest()
-        request.transactionAmount = BigDecimal((requestMap["transactionAmount"] as? Number)?.toDouble() ?: 0.0)
+        request.transactionAmount = toAmount(requestMap["transactionAmount"] as? Number ?: 0)
         request.laneNumber = requestMap["laneNumber"] as? String ?: "1"
         request.referenceNumber = requestMap["referenceNumber"] as? String ?: ""
         request.clerkNumber = requestMap["clerkNumber"] as? String
@@ -894,10 +911,10 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         request.cardholderPresentCode = CardHolderPresentCode.Present
         
         (requestMap["convenienceFeeAmount"] as? Number)?.let {
-            request.convenienceFeeAmount = BigDecimal(it.toDouble())
+            request.convenienceFeeAmount = toAmount(it)
         }
         (requestMap["salesTaxAmount"] as? Number)?.let {
-            request.salesTaxAmount = BigDecimal(it.toDouble())
+            request.salesTaxAmount = toAmount(it)
         }
         
         return request
@@ -906,7 +923,7 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
     private fun buildVoidRequest(requestMap: Map<*, *>): VoidRequest {
         val request = VoidRequest()
         request.transactionID = requestMap["transactionId"] as? String ?: ""
-        request.transactionAmount = BigDecimal((requestMap["transactionAmount"] as? Number)?.toDouble() ?: 0.0)
+        request.transactionAmount = toAmount(requestMap["transactionAmount"] as? Number ?: 0)
         request.laneNumber = requestMap["laneNumber"] as? String ?: "1"
         request.referenceNumber = requestMap["referenceNumber"] as? String ?: ""
         request.clerkNumber = requestMap["clerkNumber"] as? String
@@ -920,7 +937,7 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
 
     private fun buildAuthorizationRequest(requestMap: Map<*, *>): AuthorizationRequest {
         val request = AuthorizationRequest()
-        request.transactionAmount = BigDecimal((requestMap["transactionAmount"] as? Number)?.toDouble() ?: 0.0)
+        request.transactionAmount = toAmount(requestMap["transactionAmount"] as? Number ?: 0)
         request.laneNumber = requestMap["laneNumber"] as? String ?: "1"
         request.referenceNumber = requestMap["referenceNumber"] as? String ?: ""
         request.clerkNumber = requestMap["clerkNumber"] as? String
@@ -935,10 +952,10 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         } catch (e: Exception) { /* Method not available */ }
         
         (requestMap["convenienceFeeAmount"] as? Number)?.let {
-            request.convenienceFeeAmount = BigDecimal(it.toDouble())
+            request.convenienceFeeAmount = toAmount(it)
         }
         (requestMap["salesTaxAmount"] as? Number)?.let {
-            request.salesTaxAmount = BigDecimal(it.toDouble())
+            request.salesTaxAmount = toAmount(it)
         }
         
         return request
@@ -1044,26 +1061,10 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         )
     }
 
-    private fun getPropertySafe(obj: Any, propertyName: String): Any? {
-        return try {
-            val getterName = "get${propertyName.replaceFirstChar { it.uppercase() }}"
-            obj.javaClass.getMethod(getterName).invoke(obj)
-        } catch (e: Exception) {
-            try {
-                // Try direct field access
-                val field = obj.javaClass.getDeclaredField(propertyName)
-                field.isAccessible = true
-                field.get(obj)
-            } catch (e2: Exception) {
-                null
-            }
-        }
-    }
-
-    // Vararg version to try multiple property names
+    // Tries each property name in turn, returning the first non-null value
     private fun getPropertySafe(obj: Any, vararg propertyNames: String): Any? {
         for (name in propertyNames) {
-            val result = getPropertySafe(obj, name)
+            val result = PropertyReader.read(obj, name)
             if (result != null) return result
         }
         return null
@@ -1074,11 +1075,11 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         
         return try {
             mapOf(
-                "transactionId" to getFieldSafe(host, "TransactionID", "transactionId", "transactionID"),
-                "authCode" to getFieldSafe(host, "AuthCode", "AuthorizationCode", "authorizationCode"),
-                "responseCode" to getFieldSafe(host, "ResponseCode", "responseCode"),
-                "responseMessage" to getFieldSafe(host, "ResponseMessage", "responseMessage"),
-                "approvalNumber" to getFieldSafe(host, "ApprovalNumber", "approvalNumber")
+                "transactionId" to getPropertySafe(host, "TransactionID", "transactionId", "transactionID"),
+                "authCode" to getPropertySafe(host, "AuthCode", "AuthorizationCode", "authorizationCode"),
+                "responseCode" to getPropertySafe(host, "ResponseCode", "responseCode"),
+                "responseMessage" to getPropertySafe(host, "ResponseMessage", "responseMessage"),
+                "approvalNumber" to getPropertySafe(host, "ApprovalNumber", "approvalNumber")
             )
         } catch (e: Exception) {
             Log.e(TAG, "Error building host response map: ${e.message}")
@@ -1091,9 +1092,9 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         
         return try {
             mapOf(
-                "maskedCardNumber" to getFieldSafe(response, "AccountNumber", "MaskedAccountNumber", "maskedCardNumber", "CardNumber"),
-                "cardBrand" to getFieldSafe(response, "CardLogo", "cardLogo", "CardBrand"),
-                "entryMode" to getFieldSafe(response, "EntryMode", "entryMode")?.toString()?.lowercase()
+                "maskedCardNumber" to getPropertySafe(response, "AccountNumber", "MaskedAccountNumber", "maskedCardNumber", "CardNumber"),
+                "cardBrand" to getPropertySafe(response, "CardLogo", "cardLogo", "CardBrand"),
+                "entryMode" to getPropertySafe(response, "EntryMode", "entryMode")?.toString()?.lowercase()
             )
         } catch (e: Exception) {
             Log.e(TAG, "Error building card info map: ${e.message}")
@@ -1101,47 +1102,6 @@ class TriposMobilePlugin : FlutterPlugin, MethodCallHandler, ActivityAware {
         }
     }
 
-    // Helper to try multiple possible field/method names
-    private fun getFieldSafe(obj: Any, vararg fieldNames: String): Any? {
-        val objClass = obj.javaClass
-        
-        for (fieldName in fieldNames) {
-            // Try getter method (getXxx)
-            try {
-                val getterName = "get$fieldName"
-                val method = objClass.getMethod(getterName)
-                val result = method.invoke(obj)
-                if (result != null) return result
-            } catch (e: Exception) { /* Try next */ }
-            
-            // Try getter with lowercase first char
-            try {
-                val getterName = "get${fieldName.replaceFirstChar { it.uppercase() }}"
-                val method = objClass.getMethod(getterName)
-                val result = method.invoke(obj)
-                if (result != null) return result
-            } catch (e: Exception) { /* Try next */ }
-            
-            // Try direct field access
-            try {
-                val field = objClass.getDeclaredField(fieldName)
-                field.isAccessible = true
-                val result = field.get(obj)
-                if (result != null) return result
-            } catch (e: Exception) { /* Try next */ }
-            
-            // Try lowercase field name
-            try {
-                val field = objClass.getDeclaredField(fieldName.lowercase())
-                field.isAccessible = true
-                val result = field.get(obj)
-                if (result != null) return result
-            } catch (e: Exception) { /* Try next */ }
-        }
-        
-        return null
-    }
-
     private fun buildEmvInfoMap(response: Any?): Map<String, Any?>? {
         if (response == null) return null
         
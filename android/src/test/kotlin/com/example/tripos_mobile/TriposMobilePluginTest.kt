@@ -4,6 +4,11 @@ import io.flutter.plugin.common.MethodCall
 import io.flutter.plugin.common.MethodChannel
 import org.mockito.Mockito
 import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNull
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
 
 /*
  * This demonstrates a simple unit test of the Kotlin portion of this plugin's implementation.
@@ -24,4 +29,49 @@ internal class TriposMobilePluginTest {
 
         Mockito.verify(mockResult).success("Android " + android.os.Build.VERSION.RELEASE)
     }
+
+    @Test
+    fun toAmount_convertsToExactCents() {
+        assertEquals("10.10", toAmount(10.1).toPlainString())
+        assertEquals("5.00", toAmount(5).toPlainString())
+        assertEquals("-12.35", toAmount(-12.345).toPlainString())
+        assertEquals("-0.01", toAmount(-0.005).toPlainString())
+    }
+
+    @Test
+    fun toAmount_rejectsNonFiniteValues() {
+        assertFailsWith<InvalidAmountException> { toAmount(Double.NaN) }
+        assertFailsWith<InvalidAmountException> { toAmount(Double.POSITIVE_INFINITY) }
+    }
+
+    @Test
+    fun propertyReader_cachesResolvedAccessors() {
+        val fixture = ReflectionFixture()
+
+        assertEquals("getter", PropertyReader.read(fixture, "name"))
+        val cached = PropertyReader.accessorCache[ReflectionFixture::class.java]?.get("name")
+        assertEquals(1, cached?.size)
+        PropertyReader.read(fixture, "name")
+        assertSame(cached, PropertyReader.accessorCache[ReflectionFixture::class.java]?.get("name"))
+    }
+
+    @Test
+    fun propertyReader_cachesMisses() {
+        assertNull(PropertyReader.read(ReflectionFixture(), "missing"))
+        assertTrue(PropertyReader.accessorCache[ReflectionFixture::class.java]?.get("missing")!!.isEmpty())
+    }
+
+    @Test
+    fun propertyReader_fallsBackToFieldWhenGetterReturnsNull() {
+        assertEquals("field", PropertyReader.read(ReflectionFixture(), "label"))
+    }
+}
+
+@Suppress("unused")
+internal class ReflectionFixture {
+    private val label: String = "field"
+
+    fun getName(): String = "getter"
+
+    fun getLabel(): String? = null
 }
@@ -24,4 +24,20 @@ class RunnerTests: XCTestCase {
     waitForExpectations(timeout: 1)
   }
 
+  func testDecimalAmountRoundsToExactCents() {
+    let plugin = TriposMobilePlugin()
+
+    XCTAssertEqual(plugin.decimalAmount(10.1), NSDecimalNumber(string: "10.10"))
+    XCTAssertEqual(plugin.decimalAmount(5), NSDecimalNumber(string: "5.00"))
+    XCTAssertEqual(plugin.decimalAmount(-0.005), NSDecimalNumber(string: "-0.01"))
+  }
+
+  func testDecimalAmountRejectsNonFiniteValues() {
+    let plugin = TriposMobilePlugin()
+
+    XCTAssertNil(plugin.decimalAmount(.nan))
+    XCTAssertNil(plugin.decimalAmount(.infinity))
+    XCTAssertNil(plugin.decimalAmount(-.infinity))
+  }
+
 }
@@ -228,6 +228,12 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
             return
         }
         
+        // Build (and validate) the request before resetting the device
+        guard let request = buildSaleRequest(from: call.arguments as? [String: Any]) else {
+            result(FlutterError(code: "INVALID_AMOUNT", message: "Amount must be a finite number", details: nil))
+            return
+        }
+        
         if let device = vtp.device {
             do {
                 try device.reset()
@@ -237,8 +243,6 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
             }
         }
         
-        let request = buildSaleRequest(from: call.arguments as? [String: Any])
-        
         vtp.processSaleRequest(request, completionHandler: { [weak self] response in
             DispatchQueue.main.async {
                 result(self?.buildSaleResponseMap(from: response))
@@ -268,11 +272,15 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
             return
         }
         
+        // Build (and validate) the request before resetting the device
+        guard let request = buildRefundRequest(from: call.arguments as? [String: Any]) else {
+            result(FlutterError(code: "INVALID_AMOUNT", message: "Amount must be a finite number", details: nil))
+            return
+        }
+        
         // Reset device to cancel any ongoing transaction
         resetDevice()
         
-        let request = buildRefundRequest(from: call.arguments as? [String: Any])
-        
         vtp.processRefundRequest(request, completionHandler: { [weak self] response in
             DispatchQueue.main.async {
                 result(self?.buildRefundResponseMap(from: response))
@@ -322,7 +330,11 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
         transaction.transactionID = transactionId
         
         let amount = args["transactionAmount"] as? Double ?? 0.0
-        transaction.transactionAmount = NSDecimalNumber(value: amount)
+        guard let transactionAmount = decimalAmount(amount) else {
+            result(FlutterError(code: "INVALID_AMOUNT", message: "Amount must be a finite number", details: nil))
+            return
+        }
+        transaction.transactionAmount = transactionAmount
         transaction.referenceNumber = args["referenceNumber"] as? String ?? "\(Int(Date().timeIntervalSince1970))"
         
         let terminal = VXPTerminal()
@@ -389,7 +401,11 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
         transaction.transactionID = transactionId
         
         let amount = args["transactionAmount"] as? Double ?? 1.0
-        transaction.transactionAmount = NSDecimalNumber(value: amount)
+        guard let transactionAmount = decimalAmount(amount) else {
+            result(FlutterError(code: "INVALID_AMOUNT", message: "Amount must be a finite number", details: nil))
+            return
+        }
+        transaction.transactionAmount = transactionAmount
         transaction.referenceNumber = args["referenceNumber"] as? String ?? "\(Int(Date().timeIntervalSince1970))"
         
         let terminal = VXPTerminal()
@@ -444,11 +460,15 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
             return
         }
         
+        // Build (and validate) the request before resetting the device
+        guard let request = buildAuthorizationRequest(from: call.arguments as? [String: Any]) else {
+            result(FlutterError(code: "INVALID_AMOUNT", message: "Amount must be a finite number", details: nil))
+            return
+        }
+        
         // Reset device to cancel any ongoing transaction
         resetDevice()
         
-        let request = buildAuthorizationRequest(from: call.arguments as? [String: Any])
-        
         vtp.processAuthorizationRequest(request, completionHandler: { [weak self] response in
             DispatchQueue.main.async {
                 result(self?.buildAuthorizationResponseMap(from: response))
@@ -594,28 +614,49 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
     }
     
     // MARK: - Request Builders
-    private func buildSaleRequest(from args: [String: Any]?) -> VTPSaleRequest {
+    
+    /// Rounds amounts to cents, halves away from zero (matches RoundingMode.HALF_UP on Android).
+    private static let amountRoundingBehavior = NSDecimalNumberHandler(
+        roundingMode: .plain, scale: 2,
+        raiseOnExactness: false, raiseOnOverflow: false,
+        raiseOnUnderflow: false, raiseOnDivideByZero: false
+    )
+    
+    /// Converts a Flutter amount to an exact two-decimal NSDecimalNumber.
+    /// Parsing the shortest round-trip string keeps 10.1 as 10.10; NSDecimalNumber(value: Double)
+    /// can carry binary rounding error into the amount. Returns nil for NaN, infinity or overflow.
+    func decimalAmount(_ amount: Double) -> NSDecimalNumber? {
+        guard amount.isFinite else { return nil }
+        let decimal = NSDecimalNumber(string: "\(amount)", locale: Locale(identifier: "en_US_POSIX"))
+        guard !decimal.decimalValue.isNaN else { return nil }
+        return decimal.rounding(accordingToBehavior: TriposMobilePlugin.amountRoundingBehavior)
+    }
+    
+    private func buildSaleRequest(from args: [String: Any]?) -> VTPSaleRequest? {
         let request = VTPSaleRequest()
         
         if let amount = args?["transactionAmount"] as? Double {
-            request.transactionAmount = NSDecimalNumber(value: amount)
+            guard let transactionAmount = decimalAmount(amount) else { return nil }
+            request.transactionAmount = transactionAmount
         }
         
         request.referenceNumber = args?["referenceNumber"] as? String 
             ?? "\(Int(Date().timeIntervalSince1970))"
         
         if let convenienceFee = args?["convenienceFeeAmount"] as? Double {
-            request.convenienceFeeAmount = NSDecimalNumber(value: convenienceFee)
+            guard let convenienceFeeAmount = decimalAmount(convenienceFee) else { return nil }
+            request.convenienceFeeAmount = convenienceFeeAmount
         }
         
         return request
     }
     
-    private func buildRefundRequest(from args: [String: Any]?) -> VTPRefundRequest {
+    private func buildRefundRequest(from args: [String: Any]?) -> VTPRefundRequest? {
         let request = VTPRefundRequest()
         
         if let amount = args?["transactionAmount"] as? Double {
-            request.transactionAmount = NSDecimalNumber(value: amount)
+            guard let transactionAmount = decimalAmount(amount) else { return nil }
+            request.transactionAmount = transactionAmount
         }
         
         request.referenceNumber = args?["referenceNumber"] as? String
@@ -624,11 +665,12 @@ public class TriposMobilePlugin: NSObject, FlutterPlugin {
         return request
     }
     
-    private func buildAuthorizationRequest(from args: [String: Any]?) -> VTPAuthorizationRequest {
+    private func buildAuthorizationRequest(from args: [String: Any]?) -> VTPAuthorizationRequest? {
         let request = VTPAuthorizationRequest()
         
         if let amount = args?["transactionAmount"] as? Double {
-            request.transactionAmount = NSDecimalNumber(value: amount)
+            guard let transactionAmount = decimalAmount(amount) else { return nil }
+            request.transactionAmount = transactionAmount
         }
         
         request.referenceNumber = args?["referenceNumber"] as? String